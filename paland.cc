@@ -54,7 +54,10 @@ void require_conform(char const *expected, char const *fmt, ...) {
     npf_result = buf;
   }
 
-  std::string sys_result; {
+  // Only consult the host libc when there's no expected string, or to explain
+  // a mismatch; targets without a conforming vsnprintf can run the rest.
+  std::string sys_result;
+  if (!expected || (npf_result != expected)) {
     va_list args;
     va_start(args, fmt);
     vsnprintf(buf, sizeof(buf), fmt, args);
@@ -718,6 +721,15 @@ TEST_CASE("types") {
   require_conform("18446744073709551615", "%llu", 18446744073709551615LLU);
   require_conform("-2147483647",          "%ji", (intmax_t)-2147483647L);
   require_conform("1234567891234567",     "%llx", 0x1234567891234567LLU);
+
+  // 32-bit word boundaries; 32-bit targets split these across two registers.
+  require_conform("4294967295",           "%llu", 4294967295LLU);
+  require_conform("4294967296",           "%llu", 4294967296LLU);
+  require_conform("-4294967296",          "%lli", -4294967296LL);
+  require_conform("9999999999999999999",  "%llu", 9999999999999999999LLU);
+  require_conform("10000000000000000000", "%llu", 10000000000000000000LLU);
+  require_conform("1777777777777777777777", "%llo", 01777777777777777777777LLU);
+  require_conform("FEDCBA9876543210",     "%llX", 0xFEDCBA9876543210LLU);
 #endif
 }
 